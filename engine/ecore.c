@@ -1,8 +1,13 @@
+#define _DEFAULT_SOURCE
+
 #include "termengine.h"
 
 #include <unistd.h>
 #include <stdlib.h>
 #include <pthread.h>
+#include <signal.h>
+#include <string.h>
+#include <sys/ioctl.h>
 
 #define DEFAULT_CORE_BORDER 0
 #define DEFAULT_CORE_TARGET_FPS 12
@@ -12,12 +17,15 @@
 #define DEFAULT_CORE_INPUT_ENABLED 0
 #define DEFAULT_CORE_DEBUG_ENABLED 0
 #define DEFAULT_CORE_DEBUG_HEIGHT 3
+#define DEFAULT_CORE_RESIZE_MODE RESIZE_FIXED
 
 //======================================================
 // Variables
 //======================================================
 CoreData CORE;  // system variable. accessible to user but not recommended tinkering with
 
+static volatile sig_atomic_t resize_pending = 0;  // set by SIGWINCH, handled once per frame
+
 //======================================================
 // System Functions (Not accessable to user)
 //======================================================
@@ -29,37 +37,105 @@ void *utimesleep(void *args) {
     return NULL;
 }
 
-// Check if viewport is big enough to render
-void checkViewport() {
-    int full_height = CORE.height;  // rendered full (viewport + debug) height
-    CORE.border_padding = 0;        // border padding
-    CORE.border_padding_amt = 0;    // border padding amount
+// SIGWINCH handler
+void handleSigwinch(int sig) {
+    (void)sig;
+    resize_pending = 1;
+}
+
+// (Re)allocate and clear viewport data
+void allocViewportData(int width, int height) {
+    CORE.width = width;
+    CORE.height = height;
+    CORE.viewport_data = (Viewport *)realloc(CORE.viewport_data, (CORE.width * 2) * CORE.height * sizeof(Viewport));
+    for (int i = 0; i < (CORE.width * 2) * CORE.height; i++) {
+        CORE.viewport_data[i].ch = 0;
+        CORE.viewport_data[i].color = 0;
+    }
+}
+
+// Lay out viewport & debug menu windows for current window size
+// (Notifies resize callback if window or viewport size changed)
+void layoutViewport() {
+    int prev_width = CORE.width;
+    int prev_height = CORE.height;
+    int prev_win_width = CORE.win_width;
+    int prev_win_height = CORE.win_height;
 
-    if (CORE.border) {
-        CORE.border_padding = 1;
-        CORE.border_padding_amt = 2;
+    CORE.border_padding = CORE.border ? 1 : 0;  // border padding
 
-        if (CORE.debug_enabled) {
-            CORE.border_padding_amt += 2;
+    getmaxyx(stdscr, CORE.win_height, CORE.win_width);
+
+    int padding = CORE.border_padding * 2;
+    int debug_full_height = CORE.debug_enabled ? CORE.debug_height + padding : 0;
+
+    // Resize viewport data to fill window
+    if (CORE.resize_mode == RESIZE_FILL) {
+        int width = (CORE.win_width - padding) / 2;
+        int height = CORE.win_height - padding - debug_full_height;
+        width = width < 1 ? 1 : width;
+        height = height < 1 ? 1 : height;
+        if ((width != CORE.width) || (height != CORE.height)) {
+            allocViewportData(width, height);
         }
     }
 
-    getmaxyx(stdscr, CORE.win_height, CORE.win_width);
+    // Hide viewport if window is smaller than needed area
+    int full_width = CORE.width * 2 + padding;
+    int full_height = CORE.height + padding + debug_full_height;
+    CORE.viewport_hidden = (CORE.win_width < full_width) || (CORE.win_height < full_height);
 
-    // Full viewport height depending if debug menu is enabled
-    if (CORE.debug_enabled) {
-        full_height += CORE.debug_height;
+    int origin_x = 0;
+    int origin_y = 0;
+    if ((CORE.resize_mode == RESIZE_LETTERBOX) && !CORE.viewport_hidden) {
+        origin_x = (CORE.win_width - full_width) / 2;
+        origin_y = (CORE.win_height - full_height) / 2;
     }
 
-    // Exits if viewport is smaller than needed area
-    if ((CORE.win_height <= full_height + (CORE.border_padding * CORE.border_padding_amt)) ||
-        (CORE.win_width <= CORE.width * 2 + (CORE.border_padding * CORE.border_padding_amt))) {
-        deinitEngine();
-        printf("Exited: Window is smaller than viewport size!");
-        exit(0);
+    if (CORE.viewport) {
+        delwin(CORE.viewport);
+        CORE.viewport = NULL;
+    }
+    if (CORE.debug_menu) {
+        delwin(CORE.debug_menu);
+        CORE.debug_menu = NULL;
+    }
+
+    erase();
+    if (CORE.viewport_hidden) {
+        mvprintw(0, 0, "Window is smaller than viewport size!");
+    } else {
+        CORE.viewport = newwin(CORE.height + padding, CORE.width * 2 + padding, origin_y, origin_x);
+        if (CORE.debug_enabled) {
+            CORE.debug_menu = newwin(CORE.debug_height + padding, CORE.width * 2 + padding,
+                                     origin_y + CORE.height + padding, origin_x);
+        }
+    }
+    refresh();
+
+    if (CORE.resize_callback &&
+        ((CORE.width != prev_width) || (CORE.height != prev_height) || (CORE.win_width != prev_win_width) ||
+         (CORE.win_height != prev_win_height))) {
+        CORE.resize_callback(CORE.width, CORE.height);
     }
 }
 
+// Re-lay out viewport if window size changed since last frame
+void handleResize() {
+    resize_pending = 0;
+
+    struct winsize ws;
+    if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &ws) != 0) {
+        return;
+    }
+    if ((ws.ws_col == CORE.win_width) && (ws.ws_row == CORE.win_height)) {
+        return;
+    }
+
+    resizeterm(ws.ws_row, ws.ws_col);
+    layoutViewport();
+}
+
 //======================================================
 // Initialization
 //======================================================
@@ -82,6 +158,15 @@ void initEngine() {
     CORE.color_enabled = DEFAULT_CORE_COLOR;
     CORE.debug_enabled = DEFAULT_CORE_DEBUG_ENABLED;
     CORE.debug_height = DEFAULT_CORE_DEBUG_HEIGHT;
+    CORE.resize_mode = DEFAULT_CORE_RESIZE_MODE;
+
+    // Handle window resize ourselves (replaces ncurses handler)
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = handleSigwinch;
+    sigemptyset(&sa.sa_mask);
+    sa.sa_flags = SA_RESTART;
+    sigaction(SIGWINCH, &sa, NULL);
 }
 
 // Deinitialize Engine
@@ -101,17 +186,8 @@ void deinitEngine() {
  * @param fc      Fill character
  */
 void setViewport(int width, int height) {
-    CORE.width = width;
-    CORE.height = height;
-    CORE.viewport = newwin(CORE.height, CORE.width * 2, 0, 0);
-
-    CORE.viewport_data = (Viewport *)malloc((CORE.width * 2) * CORE.height * sizeof(Viewport));
-    for (int i = 0; i < (CORE.width * 2) * CORE.height; i++) {
-        CORE.viewport_data[i].ch = 0;
-        CORE.viewport_data[i].color = 0;
-    }
-
-    checkViewport();
+    allocViewportData(width, height);
+    layoutViewport();
 }
 
 // Enable color rendering
@@ -136,55 +212,55 @@ void setColor() {
 // Enable border
 void setBorder() {
     CORE.border = 1;
-    wresize(CORE.viewport, CORE.height + 2, (CORE.width * 2) + 2);
-    checkViewport();  // check again to make sure border is drawable
+    layoutViewport();  // lay out again to make room for border
 }
 
 // Render viewport to terminal
 void renderViewport() {
     CORE.prev_clock = clock();
 
-    // Check if window is resized
-    int nwin_width, nwin_height;
-    getmaxyx(stdscr, nwin_width, nwin_height);
-    if (CORE.win_width != nwin_width || CORE.win_height != nwin_height) {
-        checkViewport();
+    // Check if window is resized (only if not already handled by clearViewport)
+    if (resize_pending) {
+        handleResize();
     }
 
-    // Render border if border is enabled
-    if (CORE.border) {
-        box(CORE.viewport, 0, 0);
-        if (CORE.debug_enabled) {
-            box(CORE.debug_menu, 0, 0);
+    // Skip rendering until window is large enough again
+    if (!CORE.viewport_hidden) {
+        // Render border if border is enabled
+        if (CORE.border) {
+            box(CORE.viewport, 0, 0);
+            if (CORE.debug_enabled) {
+                box(CORE.debug_menu, 0, 0);
+            }
         }
-    }
 
-    // Render viewport
-    for (int i = 0; i < (CORE.width * 2) * CORE.height; i++) {
-        if (CORE.viewport_data[i].ch != 0) {
-            if (CORE.color_enabled) {
-                wattron(CORE.viewport, COLOR_PAIR(CORE.viewport_data[i].color));
-            }
+        // Render viewport
+        for (int i = 0; i < (CORE.width * 2) * CORE.height; i++) {
+            if (CORE.viewport_data[i].ch != 0) {
+                if (CORE.color_enabled) {
+                    wattron(CORE.viewport, COLOR_PAIR(CORE.viewport_data[i].color));
+                }
 
-            mvwaddch(CORE.viewport, i / (CORE.width * 2) + CORE.border_padding,
-                     i % (CORE.width * 2) + CORE.border_padding, CORE.viewport_data[i].ch);
+                mvwaddch(CORE.viewport, i / (CORE.width * 2) + CORE.border_padding,
+                         i % (CORE.width * 2) + CORE.border_padding, CORE.viewport_data[i].ch);
 
-            if (CORE.color_enabled) {
-                wattroff(CORE.viewport, COLOR_PAIR(CORE.viewport_data[i].color));
+                if (CORE.color_enabled) {
+                    wattroff(CORE.viewport, COLOR_PAIR(CORE.viewport_data[i].color));
+                }
             }
         }
-    }
-    wrefresh(CORE.viewport);
-
-    // Render debug
-    if (CORE.debug_enabled) {
-        for (int i = 0; i < CORE.debug_height; i++) {
-            if (CORE.debug_data[i].title != 0) {
-                mvwprintw(CORE.debug_menu, i + CORE.border_padding, 0 + CORE.border_padding,
-                          "%s: %s", CORE.debug_data[i].title, CORE.debug_data[i].value);
+        wrefresh(CORE.viewport);
+
+        // Render debug
+        if (CORE.debug_enabled) {
+            for (int i = 0; i < CORE.debug_height; i++) {
+                if (CORE.debug_data[i].title != 0) {
+                    mvwprintw(CORE.debug_menu, i + CORE.border_padding, 0 + CORE.border_padding,
+                              "%s: %s", CORE.debug_data[i].title, CORE.debug_data[i].value);
+                }
             }
+            wrefresh(CORE.debug_menu);
         }
-        wrefresh(CORE.debug_menu);
     }
 
     // Set frame count for next frame
@@ -204,9 +280,16 @@ void renderViewport() {
 
 // Clear viewport
 void clearViewport() {
-    werase(CORE.viewport);
-    if (CORE.debug_enabled) {
-        werase(CORE.debug_menu);
+    // Check if window is resized (at frame start so the frame is drawn at new size)
+    if (resize_pending) {
+        handleResize();
+    }
+
+    if (!CORE.viewport_hidden) {
+        werase(CORE.viewport);
+        if (CORE.debug_enabled) {
+            werase(CORE.debug_menu);
+        }
     }
     for (int i = 0; i < (CORE.width * 2) * CORE.height; i++) {
         CORE.viewport_data[i].ch = 0;
@@ -214,6 +297,28 @@ void clearViewport() {
     }
 }
 
+/**
+ * Set viewport behaviour on window resize
+ * (Resizes are applied in clearViewport. If the game never clears the viewport, they are applied in
+ *  renderViewport instead, and RESIZE_FILL shows one blank frame since viewport data is reallocated)
+ * @param mode  Resize mode (RESIZE_FIXED, RESIZE_LETTERBOX, RESIZE_FILL)
+ */
+void setResizeMode(ResizeMode mode) {
+    CORE.resize_mode = mode;
+    if (CORE.viewport_data) {
+        layoutViewport();
+    }
+}
+
+/**
+ * Set window resize callback
+ * (Called with viewport width & height whenever the window or viewport size changes)
+ * @param callback  Callback (NULL to disable)
+ */
+void setResizeCallback(void (*callback)(int width, int height)) {
+    CORE.resize_callback = callback;
+}
+
 //======================================================
 // Time
 //======================================================
@@ -271,15 +376,8 @@ void drawPoint(int x, int y, char ch, int color) {
 // Show debug menu
 void setDebug() {
     CORE.debug_enabled = 1;
-
-    int border_padding = 0;
-    if (CORE.border) {
-        border_padding = 2;
-    }
-
-    CORE.debug_menu = newwin(CORE.debug_height + border_padding, (CORE.width * 2) + border_padding,
-                             CORE.height + border_padding, 0);
-    CORE.debug_data = (Debug *)malloc(CORE.debug_height * sizeof(Debug));
+    CORE.debug_data = (Debug *)calloc(CORE.debug_height, sizeof(Debug));
+    layoutViewport();  // lay out again to make room for debug menu
 }
 
 // Update/Add debug attribute
@@ -0,0 +1,189 @@
+#include "termengine.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define DEFAULT_PARTICLE_SEED 0x9E3779B9u
+
+//======================================================
+// System Functions (Not accessable to user)
+//======================================================
+
+// Random float in [-1, 1] (xorshift32)
+static float randomUnit(unsigned int *seed) {
+    unsigned int s = *seed;
+    s ^= s << 13;
+    s ^= s >> 17;
+    s ^= s << 5;
+    *seed = s;
+    return (float)(s >> 8) * (2.0f / 16777215.0f) - 1.0f;
+}
+
+//======================================================
+// Particles
+//======================================================
+
+/**
+ * Allocate particle pool
+ * (Structure-of-arrays, single allocation)
+ * @param ps        Particle system
+ * @param capacity  Max particle count
+ * @param gravity   Vertical acceleration (precise per frame)
+ */
+void initParticleSystem(ParticleSystem *ps, int capacity, float gravity) {
+    size_t float_size = (size_t)capacity * sizeof(float);
+    size_t int_size = (size_t)capacity * sizeof(int);
+    char *pool = (char *)malloc(float_size * 5 + int_size * 2 + capacity);
+
+    ps->x = (float *)pool;
+    ps->y = (float *)(pool + float_size);
+    ps->vx = (float *)(pool + float_size * 2);
+    ps->vy = (float *)(pool + float_size * 3);
+    ps->life = (float *)(pool + float_size * 4);
+    ps->color = (int *)(pool + float_size * 5);
+    ps->cell = (int *)(pool + float_size * 5 + int_size);
+    ps->ch = pool + float_size * 5 + int_size * 2;
+
+    ps->count = 0;
+    ps->capacity = capacity;
+    ps->gravity = gravity;
+    ps->seed = DEFAULT_PARTICLE_SEED;
+}
+
+/**
+ * Free particle pool
+ * @param ps    Particle system
+ */
+void freeParticleSystem(ParticleSystem *ps) {
+    free(ps->x);
+    memset(ps, 0, sizeof(ParticleSystem));
+}
+
+/**
+ * Spawn particles
+ * (Clamped to remaining capacity)
+ * @param ps        Particle system
+ * @param count     Amount to spawn
+ * @param px        Precise x position
+ * @param py        Precise y position
+ * @param vx        X velocity (precise per frame)
+ * @param vy        Y velocity (precise per frame)
+ * @param spread    Random velocity spread added to each axis
+ * @param life      Lifetime (in frames)
+ * @param ch        Character
+ * @param color     Foreground color
+ * @return          Spawned amount
+ */
+int spawnParticles(ParticleSystem *ps, int count, float px, float py, float vx, float vy, float spread, float life,
+                   char ch, int color) {
+    if (count > ps->capacity - ps->count) {
+        count = ps->capacity - ps->count;
+    }
+    if (count <= 0) {
+        return 0;
+    }
+
+    int start = ps->count;
+    int end = start + count;
+    for (int i = start; i < end; i++) {
+        ps->x[i] = px;
+        ps->y[i] = py;
+        ps->life[i] = life;
+        ps->color[i] = color;
+    }
+    memset(ps->ch + start, ch, count);
+
+    if (spread != 0) {
+        for (int i = start; i < end; i++) {
+            ps->vx[i] = vx + randomUnit(&ps->seed) * spread;
+            ps->vy[i] = vy + randomUnit(&ps->seed) * spread;
+        }
+    } else {
+        for (int i = start; i < end; i++) {
+            ps->vx[i] = vx;
+            ps->vy[i] = vy;
+        }
+    }
+
+    ps->count = end;
+    return count;
+}
+
+/**
+ * Integrate & remove dead particles
+ * (Gravity, velocity & lifetime, then compacts live particles in place)
+ * @param ps    Particle system
+ */
+void updateParticles(ParticleSystem *ps) {
+    int count = ps->count;
+    float gravity = ps->gravity;
+    float *restrict x = ps->x;
+    float *restrict y = ps->y;
+    float *restrict vx = ps->vx;
+    float *restrict vy = ps->vy;
+    float *restrict life = ps->life;
+
+    // Branch-free passes so the compiler can vectorise them
+    for (int i = 0; i < count; i++) {
+        vy[i] += gravity;
+    }
+    for (int i = 0; i < count; i++) {
+        x[i] += vx[i];
+        y[i] += vy[i];
+        life[i] -= 1.0f;
+    }
+
+    // Compact live particles (order preserved)
+    int alive = 0;
+    for (int i = 0; i < count; i++) {
+        if (life[i] > 0) {
+            if (alive != i) {
+                x[alive] = x[i];
+                y[alive] = y[i];
+                vx[alive] = vx[i];
+                vy[alive] = vy[i];
+                life[alive] = life[i];
+                ps->color[alive] = ps->color[i];
+                ps->ch[alive] = ps->ch[i];
+            }
+            alive++;
+        }
+    }
+    ps->count = alive;
+}
+
+/**
+ * Draw particles to viewport
+ * (Clipped in one pass, then splatted directly into viewport data)
+ * @param ps    Particle system
+ */
+void drawParticles(ParticleSystem *ps) {
+    int count = ps->count;
+    int row_width = CORE.width * 2;
+    float max_x = (float)row_width;
+    float max_y = (float)CORE.height;
+    const float *restrict x = ps->x;
+    const float *restrict y = ps->y;
+    int *restrict cell = ps->cell;
+
+    for (int i = 0; i < count; i++) {
+        int inside = (x[i] >= 0) & (x[i] < max_x) & (y[i] >= 0) & (y[i] < max_y);
+        cell[i] = inside ? (int)y[i] * row_width + (int)x[i] : -1;
+    }
+
+    Viewport *viewport_data = CORE.viewport_data;
+    for (int i = 0; i < count; i++) {
+        if (cell[i] >= 0) {
+            viewport_data[cell[i]].ch = ps->ch[i];
+            viewport_data[cell[i]].color = ps->color[i];
+        }
+    }
+}
+
+/**
+ * Remove all particles
+ * @param ps    Particle system
+ */
+void clearParticles(ParticleSystem *ps) {
+    ps->count = 0;
+}
@@ -2,44 +2,11 @@
 
 #include <math.h>
 #include <stdlib.h>
-#include <string.h>
 
 //======================================================
 // Shapes
 //======================================================
 
-/**
- * Draw text
- * @param px    Precise x position
- * @param py    Precise y position
- * @param text  Text (string)
- * @param wrap  Wrap text
- * @param color Foreground color
- */
-void drawText(int px, int py, char *text, int wrap, int color) {
-    int text_len = strlen(text);
-    for (int i = 0; i < text_len; i++) {
-        if (py < CORE.height) {
-            if (text[i] != ' ') {
-                drawPixel(px, py, text[i], color);
-            }
-
-            px++;
-
-            if (px == CORE.width * 2) {
-                if (wrap) {
-                    px = 0;
-                    py++;
-                } else {
-                    break;
-                }
-            }
-        } else {
-            break;
-        }
-    }
-}
-
 /**
  * Draw line
  * (Bresenham's line algorithm)
@@ -0,0 +1,271 @@
+#include "termengine.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BANNER_GLYPH_WIDTH 3
+#define BANNER_GLYPH_HEIGHT 5
+#define BANNER_GLYPH_SPACING 1
+
+//======================================================
+// Banner Font
+//======================================================
+
+// 3x5 block glyphs, one row per byte (bit 2 is the leftmost point)
+static const unsigned char BANNER_FONT[128][BANNER_GLYPH_HEIGHT] = {
+    ['0'] = {7, 5, 5, 5, 7}, ['1'] = {2, 6, 2, 2, 7}, ['2'] = {7, 1, 7, 4, 7}, ['3'] = {7, 1, 7, 1, 7},
+    ['4'] = {5, 5, 7, 1, 1}, ['5'] = {7, 4, 7, 1, 7}, ['6'] = {7, 4, 7, 5, 7}, ['7'] = {7, 1, 1, 1, 1},
+    ['8'] = {7, 5, 7, 5, 7}, ['9'] = {7, 5, 7, 1, 7}, ['A'] = {2, 5, 7, 5, 5}, ['B'] = {6, 5, 6, 5, 6},
+    ['C'] = {3, 4, 4, 4, 3}, ['D'] = {6, 5, 5, 5, 6}, ['E'] = {7, 4, 6, 4, 7}, ['F'] = {7, 4, 6, 4, 4},
+    ['G'] = {3, 4, 5, 5, 3}, ['H'] = {5, 5, 7, 5, 5}, ['I'] = {7, 2, 2, 2, 7}, ['J'] = {1, 1, 1, 5, 2},
+    ['K'] = {5, 5, 6, 5, 5}, ['L'] = {4, 4, 4, 4, 7}, ['M'] = {5, 7, 7, 5, 5}, ['N'] = {6, 5, 5, 5, 5},
+    ['O'] = {2, 5, 5, 5, 2}, ['P'] = {6, 5, 6, 4, 4}, ['Q'] = {2, 5, 5, 6, 3}, ['R'] = {6, 5, 6, 5, 5},
+    ['S'] = {3, 4, 2, 1, 6}, ['T'] = {7, 2, 2, 2, 2}, ['U'] = {5, 5, 5, 5, 7}, ['V'] = {5, 5, 5, 5, 2},
+    ['W'] = {5, 5, 7, 7, 5}, ['X'] = {5, 5, 2, 5, 5}, ['Y'] = {5, 5, 2, 2, 2}, ['Z'] = {7, 1, 2, 4, 7},
+    [':'] = {0, 2, 0, 2, 0}, ['.'] = {0, 0, 0, 0, 2}, ['-'] = {0, 0, 7, 0, 0}, ['+'] = {0, 2, 7, 2, 0},
+    ['!'] = {2, 2, 2, 0, 2}, ['?'] = {6, 1, 2, 0, 2}, ['/'] = {1, 1, 2, 4, 4}, ['%'] = {5, 1, 2, 4, 5},
+};
+
+//======================================================
+// System Functions (Not accessable to user)
+//======================================================
+
+// Write a row of characters clipped to the viewport (spaces are transparent)
+static void writeTextRow(int px, int py, const char *text, int len, int color) {
+    int row_width = CORE.width * 2;
+    if ((py < 0) || (py >= CORE.height)) {
+        return;
+    }
+
+    int start = px < 0 ? -px : 0;
+    int end = px + len > row_width ? row_width - px : len;
+
+    Viewport *row = CORE.viewport_data + py * row_width;
+    for (int i = start; i < end; i++) {
+        if (text[i] != ' ') {
+            row[px + i].ch = text[i];
+            row[px + i].color = color;
+        }
+    }
+}
+
+// Copy a row of cells clipped to the viewport (ch 0 is transparent unless opaque)
+static void blitRow(int px, int py, const Viewport *cells, int len, int opaque) {
+    int row_width = CORE.width * 2;
+    if ((py < 0) || (py >= CORE.height)) {
+        return;
+    }
+
+    int start = px < 0 ? -px : 0;
+    int end = px + len > row_width ? row_width - px : len;
+    if (start >= end) {
+        return;
+    }
+
+    Viewport *row = CORE.viewport_data + py * row_width;
+    if (opaque) {
+        memcpy(row + px + start, cells + start, (end - start) * sizeof(Viewport));
+    } else {
+        for (int i = start; i < end; i++) {
+            if (cells[i].ch != 0) {
+                row[px + i] = cells[i];
+            }
+        }
+    }
+}
+
+// Draw text of known length
+static void drawTextN(int px, int py, const char *text, int len, int wrap, int color) {
+    int row_width = CORE.width * 2;
+
+    while ((len > 0) && (py < CORE.height) && (px < row_width)) {
+        int span = row_width - px < len ? row_width - px : len;
+        writeTextRow(px, py, text, span, color);
+        if (!wrap) {
+            break;
+        }
+
+        text += span;
+        len -= span;
+        px = 0;
+        py++;
+    }
+}
+
+//======================================================
+// Text
+//======================================================
+
+/**
+ * Draw text
+ * @param px    Precise x position
+ * @param py    Precise y position
+ * @param text  Text (string)
+ * @param wrap  Wrap text
+ * @param color Foreground color
+ */
+void drawText(int px, int py, char *text, int wrap, int color) {
+    drawTextN(px, py, text, strlen(text), wrap, color);
+}
+
+/**
+ * Draw formatted text
+ * (Formatted into the engine scratch buffer, truncated to TEXT_BUFFER_SIZE - 1)
+ * @param px        Precise x position
+ * @param py        Precise y position
+ * @param wrap      Wrap text
+ * @param color     Foreground color
+ * @param format    printf-style format
+ */
+void drawTextF(int px, int py, int wrap, int color, const char *format, ...) {
+    va_list args;
+    va_start(args, format);
+    int len = vsnprintf(CORE.text_buffer, TEXT_BUFFER_SIZE, format, args);
+    va_end(args);
+
+    if (len < 0) {
+        return;
+    }
+    if (len >= TEXT_BUFFER_SIZE) {
+        len = TEXT_BUFFER_SIZE - 1;
+    }
+    drawTextN(px, py, CORE.text_buffer, len, wrap, color);
+}
+
+/**
+ * Shape text run
+ * (Only reshaped when text or color changes, truncated to TEXT_RUN_SIZE - 1)
+ * @param run       Text run
+ * @param color     Foreground color
+ * @param format    printf-style format
+ */
+void setTextRun(TextRun *run, int color, const char *format, ...) {
+    va_list args;
+    va_start(args, format);
+    int len = vsnprintf(CORE.text_buffer, TEXT_BUFFER_SIZE, format, args);
+    va_end(args);
+
+    if (len < 0) {
+        return;
+    }
+    if (len >= TEXT_RUN_SIZE) {
+        len = TEXT_RUN_SIZE - 1;
+    }
+    if ((run->color == color) && (run->len == len) && (memcmp(run->text, CORE.text_buffer, len) == 0)) {
+        return;
+    }
+
+    memcpy(run->text, CORE.text_buffer, len);
+    run->text[len] = '\0';
+    run->len = len;
+    run->color = color;
+    run->opaque = 1;
+    for (int i = 0; i < len; i++) {
+        if (run->text[i] == ' ') {
+            run->cells[i].ch = 0;
+            run->opaque = 0;
+        } else {
+            run->cells[i].ch = run->text[i];
+        }
+        run->cells[i].color = color;
+    }
+}
+
+/**
+ * Draw text run
+ * @param px    Precise x position
+ * @param py    Precise y position
+ * @param run   Text run
+ */
+void drawTextRun(int px, int py, TextRun *run) {
+    blitRow(px, py, run->cells, run->len, run->opaque);
+}
+
+/**
+ * Render banner text
+ * (Only re-rendered when text, character or color changes, truncated to BANNER_TEXT_SIZE - 1)
+ * @param banner    Banner (zero-initialized before first use)
+ * @param text      Text (string)
+ * @param ch        Character
+ * @param color     Foreground color
+ */
+void setBanner(Banner *banner, char *text, char ch, int color) {
+    int len = strlen(text);
+    if (len >= BANNER_TEXT_SIZE) {
+        len = BANNER_TEXT_SIZE - 1;
+    }
+    if ((banner->ch == ch) && (banner->color == color) && (strlen(banner->text) == (size_t)len) &&
+        (memcmp(banner->text, text, len) == 0)) {
+        return;
+    }
+
+    memcpy(banner->text, text, len);
+    banner->text[len] = '\0';
+    banner->ch = ch;
+    banner->color = color;
+
+    // Each glyph point is drawn as a "##" pair like drawPoint
+    int glyph_advance = BANNER_GLYPH_WIDTH + BANNER_GLYPH_SPACING;
+    banner->width = len > 0 ? (len * glyph_advance - BANNER_GLYPH_SPACING) * 2 : 0;
+    banner->height = len > 0 ? BANNER_GLYPH_HEIGHT : 0;
+
+    int cell_count = banner->width * banner->height;
+    if (cell_count == 0) {
+        return;
+    }
+    if (cell_count > banner->capacity) {
+        banner->cells = (Viewport *)realloc(banner->cells, cell_count * sizeof(Viewport));
+        banner->capacity = cell_count;
+    }
+    memset(banner->cells, 0, cell_count * sizeof(Viewport));
+
+    for (int i = 0; i < len; i++) {
+        unsigned char glyph_ch = (unsigned char)banner->text[i];
+        if ((glyph_ch >= 'a') && (glyph_ch <= 'z')) {
+            glyph_ch -= 'a' - 'A';
+        }
+        if (glyph_ch >= 128) {
+            continue;
+        }
+
+        const unsigned char *glyph = BANNER_FONT[glyph_ch];
+        for (int gy = 0; gy < BANNER_GLYPH_HEIGHT; gy++) {
+            Viewport *row = banner->cells + gy * banner->width + i * glyph_advance * 2;
+            for (int gx = 0; gx < BANNER_GLYPH_WIDTH; gx++) {
+                if (glyph[gy] & (1 << (BANNER_GLYPH_WIDTH - 1 - gx))) {
+                    row[gx * 2].ch = ch;
+                    row[gx * 2].color = color;
+                    row[gx * 2 + 1].ch = ch;
+                    row[gx * 2 + 1].color = color;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Draw banner text
+ * @param x         X position
+ * @param y         Y position
+ * @param banner    Banner
+ */
+void drawBanner(int x, int y, Banner *banner) {
+    for (int i = 0; i < banner->height; i++) {
+        blitRow(x * 2, y + i, banner->cells + i * banner->width, banner->width, 0);
+    }
+}
+
+/**
+ * Free banner text
+ * @param banner    Banner
+ */
+void freeBanner(Banner *banner) {
+    free(banner->cells);
+    banner->cells = NULL;
+    banner->capacity = 0;
+    banner->width = 0;
+    banner->height = 0;
+    banner->text[0] = '\0';
+}
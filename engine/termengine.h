@@ -4,6 +4,14 @@
 #include <ncurses.h>
 #include <pthread.h>
 
+//======================================================
+// Macros Definition
+//======================================================
+
+#define TEXT_BUFFER_SIZE 256  // Formatted text scratch buffer size
+#define TEXT_RUN_SIZE 128     // Max text run length (including terminator)
+#define BANNER_TEXT_SIZE 32   // Max banner text length (including terminator)
+
 //======================================================
 // Structures Definition
 //======================================================
@@ -43,6 +51,36 @@ typedef struct Rectangle {
     int height;
 } Rectangle;
 
+typedef struct TextRun {
+    char text[TEXT_RUN_SIZE];       // Cached source text
+    Viewport cells[TEXT_RUN_SIZE];  // Shaped cells (ch 0 is transparent)
+    int len;                        // Text length
+    int opaque;                     // Run has no transparent cells
+    int color;                      // Foreground color
+} TextRun;
+
+typedef struct Banner {
+    char text[BANNER_TEXT_SIZE];  // Cached source text
+    Viewport *cells;              // Rendered cells (ch 0 is transparent)
+    int width, height;            // Rendered width & height (in pixels)
+    int capacity;                 // Allocated cell count
+    char ch;                      // Block character
+    int color;                    // Foreground color
+} Banner;
+
+typedef struct ParticleSystem {
+    float *x, *y;       // Positions (precise)
+    float *vx, *vy;     // Velocities (precise per frame)
+    float *life;        // Remaining lifetime (in frames)
+    int *color;         // Foreground colors
+    char *ch;           // Characters
+    int *cell;          // Splat scratch (viewport index or -1)
+    int count;          // Live particle count
+    int capacity;       // Max particle count
+    float gravity;      // Vertical acceleration (precise per frame)
+    unsigned int seed;  // Spawn random state
+} ParticleSystem;
+
 typedef struct CoreData {
     // Viewport
     WINDOW *viewport;           // Viewport
@@ -52,6 +90,8 @@ typedef struct CoreData {
     int target_fps;             // Viewport target refresh rate
     unsigned long frame_count;  // Frame count since program start
     int color_enabled;          // Enable color (Enabled/Disabled)
+    int resize_mode;            // Viewport resize mode
+    int viewport_hidden;        // Viewport hidden (Window is smaller than viewport)
 
     // Debug
     WINDOW *debug_menu;  // Debug menu
@@ -59,13 +99,16 @@ typedef struct CoreData {
     int debug_enabled;   // Enable debug menu (Enabled/Disabled)
     int debug_height;    // Debug menu height
 
+    // Text
+    char text_buffer[TEXT_BUFFER_SIZE];  // Formatted text scratch buffer
+
     // System
     int win_width, win_height;    // Window width & height
     long prev_clock, curr_clock;  // Recorded clock time
     pthread_t sleep_id;           // Sleep thread id
     int sleep_time;               // Sleep time (in microseconds)
     int border_padding;           // Border padding
-    int border_padding_amt;       // Total border padding amount
+    void (*resize_callback)(int width, int height);  // Called after window or viewport resize
 } CoreData;
 
 //======================================================
@@ -123,6 +166,12 @@ typedef enum {
     KEY_GRAVE = 96,          // Key: `
 } KeyboardKey;
 
+typedef enum {
+    RESIZE_FIXED = 0,  // Keep viewport size at top-left of window
+    RESIZE_LETTERBOX,  // Keep viewport size centered in window
+    RESIZE_FILL,       // Resize viewport to fill window
+} ResizeMode;
+
 //======================================================
 // Global Variables Definition
 //======================================================
@@ -145,6 +194,8 @@ void setColor();                          // Enable color rendering
 void setBorder();                         // Enable viewport border
 void renderViewport();                    // Render viewport to terminal
 void clearViewport();                     // Clear viewport
+void setResizeMode(ResizeMode mode);      // Set viewport behaviour on window resize
+void setResizeCallback(void (*callback)(int width, int height));  // Set window resize callback
 
 // Time
 
@@ -162,6 +213,24 @@ void drawCircleT(Circle circ, int fill, char ch, int color);                   /
 void drawRectangle(int x, int y, int w, int h, int fill, char ch, int color);  // Draw rectangle
 void drawRectangleT(Rectangle rect, int fill, char ch, int color);             // Draw rectangle with rectangle type
 
+// Text
+
+void drawTextF(int px, int py, int wrap, int color, const char *format, ...);  // Draw formatted text
+void setTextRun(TextRun *run, int color, const char *format, ...);            // Shape text run (cached)
+void drawTextRun(int px, int py, TextRun *run);                                // Draw text run
+void setBanner(Banner *banner, char *text, char ch, int color);                // Render banner text (cached)
+void drawBanner(int x, int y, Banner *banner);                                 // Draw banner text
+void freeBanner(Banner *banner);                                               // Free banner text
+
+// Particles
+
+void initParticleSystem(ParticleSystem *ps, int capacity, float gravity);  // Allocate particle pool
+void freeParticleSystem(ParticleSystem *ps);                               // Free particle pool
+int spawnParticles(ParticleSystem *ps, int count, float px, float py, float vx, float vy, float spread, float life, char ch, int color);  // Spawn particles
+void updateParticles(ParticleSystem *ps);                                  // Integrate & remove dead particles
+void drawParticles(ParticleSystem *ps);                                    // Draw particles to viewport
+void clearParticles(ParticleSystem *ps);                                   // Remove all particles
+
 // Collision
 
 int checkCollisionPointRect(Vector2 point, Rectangle rect);  // Check collision between point and rectangle